@@ -50,6 +50,13 @@
 #ifndef __MSArbor
  #define __MSArbor  /* self-identification - #endif at the end of the file */
 
+/*--------------------------------------------------------------------------*/
+/*------------------------------ INCLUDES ----------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <limits>
+
 /*--------------------------------------------------------------------------*/
 /*------------------------- NAMESPACE and USING ----------------------------*/
 /*--------------------------------------------------------------------------*/
@@ -60,7 +67,7 @@ namespace MSA_di_unipi_it
      The namespace MSA_di_unipi_it is defined to hold the MSArbor class. */
 
 /*--------------------------------------------------------------------------*/
-/*--------------------------- CLASS MSArbor --------------------------------*/
+/*--------------------------- CLASS MSArborT -------------------------------*/
 /*--------------------------------------------------------------------------*/
 /*--------------------------- GENERAL NOTES --------------------------------*/
 /*--------------------------------------------------------------------------*/
@@ -75,17 +82,40 @@ namespace MSA_di_unipi_it
     C++ implementation of the ARBOR algorithm [M. Fischetti and P.Toth,
     ORSA J. on Computing 5(4), 1993] for complete graphs.
 
-    Nodes and arc indices are defined to be of the public type
-    MSArbor::Index, and arc costs are defined to be of the public type
-    MSArbor::CNumber. These types, with the accompanying constants InINF and
-    C_INF, are defined in the public types part of the class. By changing
-    these definitions one can a) solve compilation problems due to different
-    type or constant names in differend compilers, and b) use "small" data
-    types, just large enough to fit the numbers in his/her instances, thereby
-    (possibly) reducing the memory footprint of the object and increasing its
-    efficiency. */
-
-class MSArbor
+    The class is a template over the three basic types it uses:
+
+    - IndexT is the type of node indices (and of the nodes of the auxiliary
+      tree); it must be an unsigned integral type able to hold 2 n - 2, as
+      its largest value is reserved (InINF);
+
+    - CNumberT is the type of arc costs; since the cost matrix is re-used to
+      store node names, it must also be able to hold 2 n - 3;
+
+    - FONumberT is the type of objective function values; it should be able
+      to hold something like (max arc cost) times (max number of nodes).
+
+    Positions in the n ( n - 1 ) cost matrix are always computed with the
+    (64-bit on all relevant platforms) type SIndex, hence the size of the
+    instances is only limited by the range of IndexT and CNumberT.
+
+    The implementation lives in MSArbor.C, where the template is explicitly
+    instantiated for the combinations of types corresponding to the typedefs
+    MSArbor, MSArborI and MSArborD at the end of this file; other
+    combinations can be obtained by adding the corresponding explicit
+    instantiation at the end of MSArbor.C. Using "small" data types, just
+    large enough to fit the numbers in the instances at hand, (possibly)
+    reduces the memory footprint of the object and increases its efficiency,
+    which is why the "compact" MSArbor, with 16-bit indices and costs, is
+    still the default one.
+
+    If MSArbor.C is compiled with OpenMP (e.g. -fopenmp), the arc scans and
+    the recomputation of the costs of the shrunk nodes of a single Solve()
+    are split among the threads when they are large enough (see MSA_PAR_MIN
+    in MSArbor.C); the result is exactly the same as with the serial code,
+    ties included. */
+
+template< class IndexT , class CNumberT , class FONumberT >
+class MSArborT
 {
 
 /*--------------------------------------------------------------------------*/
@@ -98,42 +128,91 @@ class MSArbor
 /*---------------------------- PUBLIC TYPES --------------------------------*/
 /*--------------------------------------------------------------------------*/
 
-  typedef unsigned short  Index;          ///< arc or node index ( >= 0 )
+  typedef IndexT          Index;          ///< arc or node index ( >= 0 )
   typedef Index          *Index_Set;      ///< set (array) of indices
   typedef const Index    cIndex;          ///< a read-only Index
   typedef cIndex        *cIndex_Set;      ///< read-only array
-  static cIndex InINF = 65535;            ///< the largest Index
+  static constexpr Index InINF =          ///< the largest Index
+                         std::numeric_limits< Index >::max();
+
+  typedef std::size_t     SIndex;         /**< index of an entry in the cost
+					     matrix, must be able to hold
+					     n ( n - 1 ) */
 
-  typedef short           CNumber;        /**< type of arc costs: since the
+  typedef CNumberT        CNumber;        /**< type of arc costs: since the
 					     cost matrix is re-used to store
 					     node names, it not should be
 					     (too) "smaller" than Index */
   typedef CNumber        *CRow;           ///< vector of costs
   typedef const CNumber  cCNumber;        ///< a read-only cost
   typedef cCNumber      *cCRow;           ///< read-only cost array
-  static cCNumber C_INF = 32767;          /**< the largest arc cost is
-                                             C_INF - 2, as C_INF - 1 means
-                                             "no arc is here" and C_INF is
-                                             reserved */
 
-  typedef int             FONumber;       /**< type of objective function
+  static constexpr CNumber C_INF =
+   std::numeric_limits< CNumber >::has_infinity ?
+   std::numeric_limits< CNumber >::infinity() :
+   std::numeric_limits< CNumber >::max();
+                                          /**< the reserved "infinite" cost:
+                                             the largest value for integral
+                                             types, + infinity for floating
+                                             point ones */
+
+  static constexpr CNumber C_NOARC =
+   std::numeric_limits< CNumber >::has_infinity ?
+   std::numeric_limits< CNumber >::max() : CNumber( C_INF - 1 );
+                                          /**< the cost meaning "no arc is
+                                             here", i.e., C_INF - 1 for
+                                             integral types and the largest
+                                             finite value for floating point
+                                             ones; all "true" arc costs must
+                                             be strictly smaller than this */
+
+  typedef FONumberT       FONumber;       /**< type of objective function
 					     values; should be able to hold
 					     something like (max arc cost)
 					     times (max number of nodes) */
 
+  struct Stats {                /**< statistics about the last solution */
+   unsigned long Stages;        ///< number of stages of Phase 1
+   unsigned long Contractions;  ///< number of components shrunk
+   unsigned long Scans;         ///< number of scans of active nodes
+   unsigned long ShrunkNodes;   /**< total number of nodes in the components
+				   at the time they were shrunk, i.e.,
+				   ShrunkNodes / Contractions is their
+				   average size */
+   double TPhase1;              ///< time (seconds) of Phase 1 (shrinking)
+   double TPhase2;              ///< time of Phase 2 (tree reconstruction)
+   double TPhase3;              ///< time of Phase 3 (reduced costs), if any
+   };
+
 /*--------------------------------------------------------------------------*/
 /*--------------------- PUBLIC METHODS OF THE CLASS ------------------------*/
 /*--------------------------------------------------------------------------*/
 /*---------------------------- CONSTRUCTOR ---------------------------------*/
 /*--------------------------------------------------------------------------*/
 
-   MSArbor( Index nds );
+   MSArborT( Index nds , bool copy = true , void *mem = 0 );
 
 /**< Constructor of the class: takes as parameter the number of nodes in the
    graph G. The actual graph is passed in Solve() [see below], and different
    instances can be solved by calling Solve() multiple times on the same
    MSArbor object, as long as al the instances have the same number of nodes.
-   */
+
+   All the memory of the object is one block (arena) of MemSize( nds , copy )
+   bytes. If mem != 0, it is the arena, and it must stay available for the
+   whole life of the object (no particular alignment is required); otherwise
+   the arena is allocated (and deleted) by the object. If copy == false, the
+   arena does not hold the n ( n - 1 ) working copy of the cost matrix,
+   which roughly halves the memory footprint; then, only SolveInPlace() can
+   be used [see below]. */
+
+/*--------------------------------------------------------------------------*/
+/*-------------------------- OTHER INITIALIZATIONS -------------------------*/
+/*--------------------------------------------------------------------------*/
+
+   static std::size_t MemSize( Index nds , bool copy = true );
+
+/**< Returns the number of bytes of the arena of a MSArbor with nds nodes,
+   with or without the working copy of the cost matrix [see MSArborT()]. */
 
 /*--------------------------------------------------------------------------*/
 /*-------------------- METHODS FOR SOLVING THE PROBLEM ---------------------*/
@@ -154,23 +233,124 @@ class MSArbor
 
    Although the algorithm is developed with complete graphs in mind, it is
    possible to try solve non-complete instances by giving not-existent arcs
-   the "plus infinity" cost C_INF - 1. If the costs of all other nodes are
-   suitably smaller than that, then the optimal solution will avoid these
-   arcs. However, if there is *no* feasible solution *not* using at least
-   one arc with cost C_INF - 1, then the best possible unfeasible solution
-   will be reported instead with no warning, so it is the user's
-   responsibility to check feasibility if that is in doubt. Also, note that
-   arcs should *never* be given cost C_INF, since that value is reserved for
-   special use by the code.
+   the "plus infinity" cost C_NOARC (= C_INF - 1 for integral costs). If the
+   costs of all other nodes are suitably smaller than that, then the optimal
+   solution will avoid these arcs. However, if there is *no* feasible
+   solution *not* using at least one arc with cost C_NOARC, then the best
+   possible unfeasible solution will be reported instead with no warning, so
+   it is the user's responsibility to check feasibility if that is in doubt.
+   Also, note that arcs should *never* be given cost C_INF, since that value
+   is reserved for special use by the code; conversely, the "diagonal" arcs
+   ( i , i ) *must* have cost C_INF, as the arc scans do look at them.
 
    If RC != 0 (= NULL), after that the Minimum Spanning Arborescence has been
    found its optimal arc reduced costs are written in RC, in the same format
-   as the arc cost vector C.
-
-   \warning the current implementation of the reduced cost computation is a
-            "naive" one, which has an O(n^3) worst case complexity; a smarter 
-            O(n^2) implementation is possible, but it is not implemented as 
-            yet. Note that the MSA computation has an O(n^2) cost. */
+   as the arc cost vector C. The reduced cost computation has an O(n^2)
+   cost, the same as that of the MSA computation.
+
+   If a root r != n - 1 has been set with SetRoot(), C (and RC) must have
+   all the n Backward Stars BS[ 0 ], .., BS[ n - 1 ], with BS[ r ] being
+   ignored (and not touched in RC). This costs nothing more than the usual
+   copy of C, as nodes r and n - 1 are just swapped while copying and then
+   back in the results; in particular, ReadPred(), ReadAux() and GetU() are
+   in terms of the original node names. */
+
+/*--------------------------------------------------------------------------*/
+
+   FONumber SolveInPlace( CRow C );
+
+/**< Same as Solve(), except that the given cost matrix C is directly used as
+   the working matrix of the algorithm, rather than being copied into the
+   one of the object; this saves the copy, and the memory for the internal
+   matrix can be spared altogether [see MSArborT()]. The content of C is
+   destroyed: since the reduced costs need the original costs, they are not
+   available. C must have one more cell than in Solve(), i.e.,
+   n ( n - 1 ) + 1, the content of the last one being irrelevant. If a root
+   r != n - 1 has been set, C has all the n Backward Stars as in Solve(),
+   and O( n ) entries are moved to swap nodes r and n - 1. */
+
+/*--------------------------------------------------------------------------*/
+
+   FONumber SolveBestRoot( cCRow C );
+
+/**< Finds the arborescence of minimum cost among those rooted at any node
+   of a graph with n' = n - 1 nodes, i.e., the object must have been
+   constructed with one more node than the graph. C has the n' Backward
+   Stars of the graph, each with n' entries, i.e., C[ i + n' * j ] is the
+   cost of ( i , j ), and as in Solve() the "diagonal" arcs ( i , i ) must
+   have cost C_INF.
+
+   Rather than solving n' problems, the one on the graph plus a "super-root"
+   n' with an arc to each node, of cost larger than any other arc cost, is
+   solved once; an optimal solution of it uses only one arc out of the
+   super-root, whose head is the best root. The best root can be read with
+   GetRoot(), and ReadPred() is the optimal arborescence on the n' original
+   nodes; GetM(), ReadAux() and GetU() describe the dual solution of the
+   problem with the super-root. If some arcs have cost C_NOARC, the result
+   is only meaningful if some node can reach all the others without them:
+   otherwise, the super-root may have more than one son, in which case the
+   first one is taken as the root, the others are attached to it by the
+   corresponding arcs (which ReadPred() then reports), and the returned
+   value is the cost of this arborescence, which need not be optimal.
+
+   The reduced costs are not available, and ReSolve() can not be used
+   afterwards; the best root also stays set as if by SetRoot(). */
+
+/*--------------------------------------------------------------------------*/
+
+   FONumber ReSolve( cCRow C , Index k , cIndex_Set Tail , cIndex_Set Head ,
+		     CRow RC = 0 );
+
+/**< Re-solves the problem after that the costs of the k arcs ( Tail[ i ] ,
+   Head[ i ] ), i = 0, ..., k - 1 have been changed w.r.t. the last call to
+   Solve() [or ReSolve()]; C is the whole new cost vector, in the same
+   format as in Solve(), which already contains the changes. Only the heads
+   of the changed arcs matter, as all the arcs entering the same node are
+   handled together; Tail is not used, and it can be 0.
+
+   First, the solution (primal and dual) of the previous call is kept, and
+   only the dual variables of the heads of the changed arcs are updated,
+   which costs O(n) for each distinct head; if this gives an optimal
+   solution for the new costs, that is returned. This is the "fast" case,
+   which happens when the arcs whose cost changes are not in the optimal
+   arborescence, or their cost decreases, or the arc which has to enter
+   their head anyway is clear.
+
+   Otherwise, the solution is locally repaired: the components (nodes of
+   the auxiliary tree) containing the head of some changed arc are undone,
+   those not containing any are kept as they are, as they only depend on the
+   costs of the arcs entering their nodes, and Phase 1 of the algorithm is
+   resumed from the contracted graph that is left. The costs between its
+   nodes are recomputed from C only for the nodes that were in some undone
+   component, which costs O(n) for each original node in them. This
+   requires the contracted costs left by the last Phase 1, i.e., that the
+   previous call was Solve() or ReSolve() (not SolveInPlace()), otherwise
+   the problem is re-solved from scratch with Solve(). This is also done
+   when the undone components contain more than half of the nodes (say,
+   when a head is inside the top-level component), as the repair would then
+   cost more than solving from scratch. In all cases, the
+   solution may not be the same that Solve() would give when there are
+   ties, but it is optimal anyway.
+
+   If RC != 0, it is updated: in the "fast" case it must contain the reduced
+   costs computed by the previous call, and only the columns of the heads of
+   the changed arcs are touched (reduced costs larger than C_NOARC being
+   capped to C_NOARC), otherwise it is entirely recomputed as in Solve().
+
+   Bound fixing is done in the same way: an arc ( i , j ) is forbidden by
+   giving it cost C_NOARC, and it is forced by giving cost C_NOARC to all the
+   other arcs entering j (in both cases, all these are the changed arcs).
+   Forbidding an arc of the arborescence, or forcing one that is not, is
+   never the "fast" case, but it is a local repair. */
+
+/*--------------------------------------------------------------------------*/
+
+   inline void SetRoot( Index r );
+
+/**< Sets the root node of the arborescence for all the subsequent calls to
+   Solve(), SolveInPlace() and ReSolve(); it is n - 1 if SetRoot() is never
+   called. Note that this changes the format of the cost matrix [see
+   Solve()], unless r == n - 1. */
 
 /*--------------------------------------------------------------------------*/
 /*------------------------ METHODS FOR READING RESULTS ---------------------*/
@@ -184,7 +364,27 @@ class MSArbor
    For each node i = 0, ..., n - 2, j = ReadPred()[ i ] is the predecessor of
    i in the spanning tree, and therefore arc (i, j) belongs to the optimal
    solution. The root has no predecessor, hence the entry n - 1 of the
-   returned vector should not be checked. */
+   returned vector should not be checked; if the root is some other node r
+   [see SetRoot() and SolveBestRoot()], it is entry r that is InINF. */
+
+/*--------------------------------------------------------------------------*/
+
+   inline Index GetRoot( void ) const;
+
+/**< Returns the root of the last solution found, i.e., either the one set
+   by SetRoot() or that found by SolveBestRoot(). */
+
+/*--------------------------------------------------------------------------*/
+
+   inline const Stats &GetStats( void ) const;
+
+/**< Returns statistics about the last run of the algorithm (i.e., not the
+   "fast" case of ReSolve()); for a local repair of ReSolve(), they only
+   count the work done by the repair. They are only collected if
+   MSArbor.C is compiled with the macro MSA_STATS > 0, so that they cost
+   nothing otherwise (and are all zero); with MSA_STATS > 1, the solution
+   is also checked for correctness after each solve, any error being
+   reported on cerr. */
 
 /*--------------------------------------------------------------------------*/
 
@@ -202,8 +402,8 @@ class MSArbor
    of nodes, arranged in a tree structure (called the "auxiliary tree") and
    with a dual variable attached to each. GetM() and ReadAux() describe the
    topology of the auxiliary tree: GetM() returns the number of its nodes,
-   while ReadAux()[ i ] is the predecessor function of the tree. Note that 
-   the tree does not include a dummy root node, thus the sons of the dummy 
+   while ReadAux()[ i ] is the predecessor function of the tree. Note that
+   the tree does not include a dummy root node, thus the sons of the dummy
    root have predecessor  InINF. Finally, GetU()[ i ] is the value of the
    optimal dual variable associated with the set (node of the auxiliary
    tree) i. */
@@ -220,7 +420,7 @@ class MSArbor
 /*------------------------------ DESTRUCTOR --------------------------------*/
 /*--------------------------------------------------------------------------*/
 
-   ~MSArbor();
+   ~MSArborT();
 
 /*--------------------------------------------------------------------------*/
 /*-------------------- PROTECTED PART OF THE CLASS -------------------------*/
@@ -228,28 +428,70 @@ class MSArbor
 
  protected:
 
+/*--------------------------------------------------------------------------*/
+/*-------------------------- PROTECTED METHODS -----------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  FONumber Arbor( cCRow C , CRow RC , bool resume = false );
+
+/* Solves the problem whose costs are in the working matrix c, which is
+   destroyed; C is only used to compute the reduced costs, if RC != 0. If
+   resume == true, Phase 1 starts from the contracted graph left by Undo()
+   rather than from the original one. */
+
+  bool Undo( cCRow C , Index k , cIndex_Set Head );
+
+/* Prepares the local repair of ReSolve(): undoes the components of the
+   auxiliary tree containing the heads in Head[] (or those changed by the
+   "fast" case of a previous ReSolve()), renumbers the kept ones as
+   n, n + 1, ..., m, and recomputes from C the costs in c between the roots
+   of what is left of the auxiliary tree that are no longer valid. Returns
+   false, without recomputing anything, if the roots to be recomputed
+   contain more than half of the nodes: then the repair is not worth it,
+   and Solve() has to be called instead. */
+
+  void DualSums( Index Head );
+
+/* For each node k of the auxiliary tree, writes in DSUM[ k ] the sum of the
+   dual variables of the ancestors of Head (Head included) which are proper
+   descendants of the common ancestor of k and Head, so that the reduced
+   cost of ( k , Head ) is c( k , Head ) - DSUM[ k ]. Costs O( m ); POS[] must
+   be all 0 on entry, and it is so on exit. */
+
 /*--------------------------------------------------------------------------*/
 /*--------------------- PROTECTED DATA STRUCTURES --------------------------*/
 /*--------------------------------------------------------------------------*/
 
   Index  n;          // Total number of nodes of the graph
   Index  m;          // size of the dual tree (<= 2 n - 2)
-  Index  root;       // n - 1          
-  Index  csize;      // ( n - 1 ) * n : size of the cost array
+  Index  root;       // n - 1, the root of the internal problem
+  Index  rt;         // the root of the actual problem [see SetRoot()]
+  SIndex csize;      // ( n - 1 ) * n : size of the cost array
   Index  gsize;      // 2 * n - 3 : max number of nodes in the auxiliary tree,
-                     // i.e. original nodes plus supernodes representing 
+                     // i.e. original nodes plus supernodes representing
                      // strongly connected components
 
+  FONumber LastZ;    // value of the last solution found
+  Stats stats;       // statistics of the last solution [see GetStats()]
+  bool solved;       // true if a solution is available (for ReSolve())
+  bool resumable;    // true if c holds the contracted costs left by the
+                     // last Phase 1 (for the local repair of ReSolve())
+
+  char *ARENA;       // the memory of all the arrays below, if allocated by
+                     // the object, 0 if given by the caller
+
   Index_Set P;       // n array, predecessor function of the optimal tree
 
   CRow c;            // ( n - 1 ) * n  matrix: initially, row j gives the
                      // costs of arcs in BS( j ), c( i , i ) == +INF, and the
-                     // root has no BS
+                     // root has no BS; 0 if copy == false in the constructor
 
   CRow rU;           // ( 2 n - 2 ) array. rU[ j ] == dual variable associated
                      // with node j
 
-  Index_Set LABEL;   // n array. LABEL[ j ] == stage where node j is labeled
+  Index_Set LABEL;   // n array. LABEL[ j ] == stage where node j is labeled;
+                     // after Phase 1, LABEL[ j ] == 0 for an original node
+                     // j whose entering arcs have changed since then
   Index_Set PARENT;  // ( 2 n - 2 ) array. PARENT[ j ] == predecessor of j in
                      // the auxiliary tree
   Index_Set ARCT;    // ( 2 n - 2 ) arrays: ARC*[ j ] == Tail and Head of
@@ -265,48 +507,134 @@ class MSArbor
   Index_Set POS;     // ( 2 n - 2 ) array. POS[ j ] == position of node j in
                      // ACTIVE; if j is not in the current graph, then
                      // POS[ j ] == UNDEFINED
+  Index_Set ALINE;   // ( 2 n - 2 ) array. ALINE[ j ] == LINE[ ACTIVE[ j ] ],
+                     // so that the arc scans in Phase 1 read it sequentially
+  Index_Set SLINE;   // n array. SLINE[ k ] == LINE[ STACK[ k ] ] for the
+                     // nodes of the component being shrunk
+  Index_Set MINV;    // ( 2 n - 2 ) arrays: when computing BS[ m ], MINC[ j ]
+  CRow MINC;         // and STACK[ MINV[ j ] ] are the cost and head of the
+                     // current best arc from ACTIVE[ j ] to m
+
+  FONumber *DSUM;    // ( 2 n - 2 ) array, only used for computing reduced
+                     // costs: DSUM[ j ] == sum of the dual variables of the
+                     // nodes separating j from the current Head
+
+  SIndex *PCNT;      // ( 2 n - 2 ) / 2048 + 1 array: number of ties in each
+                     // chunk of ACTIVE in the parallel arc scans
+
+/*--------------------------------------------------------------------------*/
+
+ };  // end( class MSArborT )
 
 /*--------------------------------------------------------------------------*/
+/*-------------------------- PREDEFINED TYPES ------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+typedef MSArborT< unsigned short , short , int > MSArbor;
+
+/**< The "compact" MSArbor, with 16-bit node indices and arc costs: the cost
+   matrix of an instance with a few hundreds nodes comfortably fits in L2,
+   but this only works for n <= 16384 and arc costs < 32766. */
+
+typedef MSArborT< unsigned int , int , long long > MSArborI;
+
+/**< The "wide" integral MSArbor, with 32-bit node indices and arc costs and
+   64-bit objective function values, for large instances and/or costs. */
 
- };  // end( class MSArbor )
+typedef MSArborT< unsigned int , double , double > MSArborD;
+
+/**< The floating point MSArbor, with 32-bit node indices and double arc
+   costs; note that no "epsilon" is used in the comparisons between costs,
+   so ties are broken exactly as in the integral case. */
 
 /*--------------------------------------------------------------------------*/
 /*------------------- inline methods implementation ------------------------*/
 /*--------------------------------------------------------------------------*/
 
-inline MSArbor::cIndex_Set MSArbor::ReadPred( void ) const
+template< class IndexT , class CNumberT , class FONumberT >
+constexpr typename MSArborT< IndexT , CNumberT , FONumberT >::Index
+ MSArborT< IndexT , CNumberT , FONumberT >::InINF;
+
+template< class IndexT , class CNumberT , class FONumberT >
+constexpr typename MSArborT< IndexT , CNumberT , FONumberT >::CNumber
+ MSArborT< IndexT , CNumberT , FONumberT >::C_INF;
+
+template< class IndexT , class CNumberT , class FONumberT >
+constexpr typename MSArborT< IndexT , CNumberT , FONumberT >::CNumber
+ MSArborT< IndexT , CNumberT , FONumberT >::C_NOARC;
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::cIndex_Set
+ MSArborT< IndexT , CNumberT , FONumberT >::ReadPred( void ) const
 {
  return( P );
  }
 
 /*--------------------------------------------------------------------------*/
 
-inline MSArbor::cIndex_Set MSArbor::ReadAux( void ) const
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::cIndex_Set
+ MSArborT< IndexT , CNumberT , FONumberT >::ReadAux( void ) const
 {
  return( PARENT );
  }
 
 /*--------------------------------------------------------------------------*/
 
-inline MSArbor::Index MSArbor::GetM( void ) const
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::Index
+ MSArborT< IndexT , CNumberT , FONumberT >::GetM( void ) const
 {
  return( m );
  }
 
 /*--------------------------------------------------------------------------*/
 
-inline MSArbor::cCRow MSArbor::GetU( void ) const
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::cCRow
+ MSArborT< IndexT , CNumberT , FONumberT >::GetU( void ) const
 {
  return ( rU );
  }
 
 /*--------------------------------------------------------------------------*/
 
-inline MSArbor::Index MSArbor::GetN( void ) const
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::Index
+ MSArborT< IndexT , CNumberT , FONumberT >::GetN( void ) const
 {
  return( n );
  }
 
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline void MSArborT< IndexT , CNumberT , FONumberT >::SetRoot( Index r )
+{
+ rt = r;
+ solved = false;
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename MSArborT< IndexT , CNumberT , FONumberT >::Index
+ MSArborT< IndexT , CNumberT , FONumberT >::GetRoot( void ) const
+{
+ return( rt );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline const typename MSArborT< IndexT , CNumberT , FONumberT >::Stats &
+ MSArborT< IndexT , CNumberT , FONumberT >::GetStats( void ) const
+{
+ return( stats );
+ }
+
 /*--------------------------------------------------------------------------*/
 
  };  // end( namespace MSA_di_unipi_it )
@@ -0,0 +1,254 @@
+/*--------------------------------------------------------------------------*/
+/*------------------------ File MSArborBatch.h -----------------------------*/
+/*--------------------------------------------------------------------------*/
+/** @file
+ * Solves batches of independent Minimal Spanning Arborescence problems of
+ * the same size in parallel, with a pool of threads each owning its own
+ * MSArbor object.
+ *
+ * \version 1.00
+ *
+ * \date 17 - 10 - 2026
+ *
+ * \author agent
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ * or check www.gnu.org.
+ */
+
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*----------------------------- DEFINITIONS --------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#ifndef __MSArborBatch
+ #define __MSArborBatch  /* self-identification - #endif at the end of the
+			    file */
+
+/*--------------------------------------------------------------------------*/
+/*------------------------------ INCLUDES ----------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#include "MSArbor.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/*--------------------------------------------------------------------------*/
+/*------------------------- NAMESPACE and USING ----------------------------*/
+/*--------------------------------------------------------------------------*/
+
+namespace MSA_di_unipi_it
+{
+
+/*--------------------------------------------------------------------------*/
+/*------------------------- CLASS MSArborBatchT ----------------------------*/
+/*--------------------------------------------------------------------------*/
+/*--------------------------- GENERAL NOTES --------------------------------*/
+/*--------------------------------------------------------------------------*/
+/** Solves batches of N independent MSA instances with the same number of
+    nodes n, each one given by its own cost matrix in the format of
+    MSArborT::Solve(). The class is a template over the MSArborT class
+    (MSA) used to solve each single instance.
+
+    The constructor creates a pool of threads, each one owning its own MSA
+    object, which are then re-used by all the subsequent calls to Solve():
+    no memory is allocated while a batch is being solved. The calling thread
+    also works as one of the workers, so a pool of t threads only creates
+    t - 1 new ones.
+
+    At the start of each batch the instances are evenly split among the
+    workers; since the instances may well have very different difficulty, a
+    worker who has finished its share "steals" half of the remaining share
+    of another one, until all the instances are solved.
+
+    The implementation lives in MSArborBatch.C, where the template is
+    explicitly instantiated for the MSArbor, MSArborI and MSArborD types. */
+
+template< class MSA >
+class MSArborBatchT
+{
+
+/*--------------------------------------------------------------------------*/
+/*----------------------- PUBLIC PART OF THE CLASS -------------------------*/
+/*--------------------------------------------------------------------------*/
+
+ public:
+
+/*--------------------------------------------------------------------------*/
+/*---------------------------- PUBLIC TYPES --------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  typedef typename MSA::Index     Index;      ///< node index
+  typedef typename MSA::Index_Set Index_Set;  ///< set (array) of indices
+  typedef typename MSA::SIndex    SIndex;     ///< index of instances
+
+  typedef typename MSA::CNumber   CNumber;    ///< type of arc costs
+  typedef typename MSA::CRow      CRow;       ///< vector of costs
+  typedef typename MSA::cCRow     cCRow;      ///< read-only cost array
+
+  typedef typename MSA::FONumber  FONumber;   ///< type of objective values
+
+/*--------------------------------------------------------------------------*/
+/*--------------------- PUBLIC METHODS OF THE CLASS ------------------------*/
+/*--------------------------------------------------------------------------*/
+/*---------------------------- CONSTRUCTOR ---------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+   MSArborBatchT( Index nds , unsigned int nthr = 0 );
+
+/**< Constructor of the class: takes as parameter the number of nodes of the
+   instances and the number of threads (workers) to be used; nthr == 0
+   means "as many as the hardware supports". */
+
+/*--------------------------------------------------------------------------*/
+/*-------------------- METHODS FOR SOLVING THE PROBLEM ---------------------*/
+/*--------------------------------------------------------------------------*/
+
+   void Solve( SIndex N , const cCRow *C , FONumber *Z , Index_Set P ,
+	       const CRow *RC = 0 );
+
+/**< Solves the N instances whose cost matrices are C[ 0 ], ..., C[ N - 1 ],
+   each in the format of MSArborT::Solve(), and returns when all of them are
+   solved. The results of instance k are written in:
+
+   - Z[ k ], the optimal value (if Z != 0);
+
+   - P[ k * ( n - 1 ) ], ..., P[ k * ( n - 1 ) + n - 2 ], the predecessor
+     function of the optimal MSA as in MSArborT::ReadPred() (if P != 0);
+
+   - RC[ k ], the reduced costs as in MSArborT::Solve() (if RC != 0 and
+     RC[ k ] != 0).
+
+   Solve() must not be called concurrently by different threads on the same
+   object. */
+
+/*--------------------------------------------------------------------------*/
+/*-------------- METHODS FOR READING THE DATA OF THE PROBLEM ---------------*/
+/*--------------------------------------------------------------------------*/
+
+   inline Index GetN( void ) const;
+
+/**< Returns the size of the instances (number of nodes). */
+
+/*--------------------------------------------------------------------------*/
+
+   inline unsigned int GetNThreads( void ) const;
+
+/**< Returns the number of workers, the calling thread included. */
+
+/*--------------------------------------------------------------------------*/
+/*------------------------------ DESTRUCTOR --------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+   ~MSArborBatchT();
+
+/*--------------------------------------------------------------------------*/
+/*-------------------- PROTECTED PART OF THE CLASS -------------------------*/
+/*--------------------------------------------------------------------------*/
+
+ protected:
+
+/*--------------------------------------------------------------------------*/
+/*--------------------------- PROTECTED TYPES ------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  struct alignas( 64 ) Worker {  // on its own cache line
+   std::mutex lock;   // protects lo and hi
+   SIndex lo;         // the instances lo <= k < hi are still to be
+   SIndex hi;         // solved by this worker
+   MSA *solver;       // the workspace
+   };
+
+/*--------------------------------------------------------------------------*/
+/*-------------------------- PROTECTED METHODS -----------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  void Loop( unsigned int w );
+
+  void Work( unsigned int w );
+
+  bool Next( unsigned int w , SIndex &k );
+
+/*--------------------------------------------------------------------------*/
+/*--------------------- PROTECTED DATA STRUCTURES --------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  Index  n;                     // number of nodes of the instances
+  unsigned int nthr;            // number of workers
+
+  Worker *WORKER;               // nthr array of workers
+  std::thread *THREAD;          // ( nthr - 1 ) array of threads, THREAD[ w ]
+                                // runs WORKER[ w + 1 ]
+
+  std::mutex pool;              // protects round, running and quit
+  std::condition_variable wake; // signals a new round (or quit)
+  std::condition_variable done; // signals the end of the round
+  unsigned long round;          // number of batches started so far
+  unsigned int running;         // number of threads still busy in the round
+  bool quit;                    // true if the threads have to terminate
+
+  const cCRow *BC;              // the data of the current batch, as passed
+  FONumber *BZ;                 // to Solve()
+  Index_Set BP;
+  const CRow *BRC;
+
+/*--------------------------------------------------------------------------*/
+
+ };  // end( class MSArborBatchT )
+
+/*--------------------------------------------------------------------------*/
+/*-------------------------- PREDEFINED TYPES ------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+typedef MSArborBatchT< MSArbor > MSArborBatch;
+
+typedef MSArborBatchT< MSArborI > MSArborBatchI;
+
+typedef MSArborBatchT< MSArborD > MSArborBatchD;
+
+/*--------------------------------------------------------------------------*/
+/*------------------- inline methods implementation ------------------------*/
+/*--------------------------------------------------------------------------*/
+
+template< class MSA >
+inline typename MSArborBatchT< MSA >::Index MSArborBatchT< MSA >::GetN(
+								   void ) const
+{
+ return( n );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class MSA >
+inline unsigned int MSArborBatchT< MSA >::GetNThreads( void ) const
+{
+ return( nthr );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+ };  // end( namespace MSA_di_unipi_it )
+
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#endif  /* MSArborBatch included */
+
+/*--------------------------------------------------------------------------*/
+/*--------------------- End File MSArborBatch.h ----------------------------*/
+/*--------------------------------------------------------------------------*/
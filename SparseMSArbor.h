@@ -0,0 +1,346 @@
+/*--------------------------------------------------------------------------*/
+/*----------------------- File SparseMSArbor.h -----------------------------*/
+/*--------------------------------------------------------------------------*/
+/** @file
+ * Solves the Minimal Spanning Arborescence problem on sparse graphs, with
+ * a C++ implementation of the contraction algorithm of Edmonds in the
+ * O( m log n ) version of [R.E. Tarjan, Networks 7, 1977] as corrected by
+ * [P.M. Camerini, L. Fratta and F. Maffioli, Networks 9, 1979], using
+ * mergeable heaps of arcs.
+ *
+ * \version 1.00
+ *
+ * \date 17 - 10 - 2026
+ *
+ * \author agent
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ * or check www.gnu.org.
+ */
+
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*----------------------------- DEFINITIONS --------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#ifndef __SparseMSArbor
+ #define __SparseMSArbor  /* self-identification - #endif at the end of the
+			     file */
+
+/*--------------------------------------------------------------------------*/
+/*------------------------------ INCLUDES ----------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <limits>
+
+/*--------------------------------------------------------------------------*/
+/*------------------------- NAMESPACE and USING ----------------------------*/
+/*--------------------------------------------------------------------------*/
+
+namespace MSA_di_unipi_it
+{
+
+/*--------------------------------------------------------------------------*/
+/*------------------------ CLASS SparseMSArborT ----------------------------*/
+/*--------------------------------------------------------------------------*/
+/*--------------------------- GENERAL NOTES --------------------------------*/
+/*--------------------------------------------------------------------------*/
+/** Solves the same Minimal Spanning Arborescence problem as MSArborT, with
+    root r = n - 1, but on a sparse directed graph G = ( N , A ) given by
+    its Backward Stars in CSR format. The cost is O( m log n ), with m = |A|,
+    rather than the O( n^2 ) of ARBOR, and no n ( n - 1 ) cost matrix is
+    ever formed.
+
+    The results are given in the same format as in MSArborT: ReadPred() is
+    the predecessor function of the optimal MSA, and GetM(), ReadAux() and
+    GetU() describe the optimal dual solution in terms of the auxiliary tree
+    of the shrunken components. The optimal solution and its value are the
+    same as these of MSArborT on the complete graph where the missing arcs
+    have cost C_NOARC, but when there are ties the two codes may well
+    return different optimal solutions. Unlike MSArborT, infeasibility
+    (some node not being reachable from the root) is explicitly reported.
+
+    The meaning of the template parameters, and the predefined types at the
+    end of the file, are the same as for MSArborT. */
+
+template< class IndexT , class CNumberT , class FONumberT >
+class SparseMSArborT
+{
+
+/*--------------------------------------------------------------------------*/
+/*----------------------- PUBLIC PART OF THE CLASS -------------------------*/
+/*--------------------------------------------------------------------------*/
+
+ public:
+
+/*--------------------------------------------------------------------------*/
+/*---------------------------- PUBLIC TYPES --------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  typedef IndexT          Index;          ///< node index ( >= 0 )
+  typedef Index          *Index_Set;      ///< set (array) of indices
+  typedef const Index    cIndex;          ///< a read-only Index
+  typedef cIndex        *cIndex_Set;      ///< read-only array
+  static constexpr Index InINF =          ///< the largest Index
+                         std::numeric_limits< Index >::max();
+
+  typedef std::size_t     SIndex;         ///< arc index, must hold m
+  typedef const SIndex   cSIndex;         ///< a read-only SIndex
+  typedef cSIndex       *cSIndex_Set;     ///< read-only array of SIndex
+
+  typedef CNumberT        CNumber;        ///< type of arc costs
+  typedef CNumber        *CRow;           ///< vector of costs
+  typedef const CNumber  cCNumber;        ///< a read-only cost
+  typedef cCNumber      *cCRow;           ///< read-only cost array
+
+  typedef FONumberT       FONumber;       ///< type of objective values
+
+  static constexpr FONumber FO_INF =
+   std::numeric_limits< FONumber >::has_infinity ?
+   std::numeric_limits< FONumber >::infinity() :
+   std::numeric_limits< FONumber >::max();
+                                          /**< the value returned by Solve()
+                                             if the instance is unfeasible */
+
+/*--------------------------------------------------------------------------*/
+/*--------------------- PUBLIC METHODS OF THE CLASS ------------------------*/
+/*--------------------------------------------------------------------------*/
+/*---------------------------- CONSTRUCTOR ---------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+   SparseMSArborT( Index nds , SIndex arcs = 0 );
+
+/**< Constructor of the class: takes as parameter the number of nodes in the
+   graph G and, possibly, the maximum number of arcs of the instances that
+   will be solved. The actual graph is passed in Solve() [see below], and
+   different instances with the same number of nodes can be solved by
+   calling Solve() multiple times; the memory for the arcs is (re)allocated
+   by Solve() if the instance has more arcs than previously accounted for.
+   */
+
+/*--------------------------------------------------------------------------*/
+/*-------------------- METHODS FOR SOLVING THE PROBLEM ---------------------*/
+/*--------------------------------------------------------------------------*/
+
+   FONumber Solve( cSIndex_Set Beg , cIndex_Set Tail , cCRow C );
+
+/**< This method solves the Minimum Spanning Arborescence problem on the
+   graph described by the three vectors Beg[], Tail[] and C[], which give
+   the n - 1 Backward Stars BS[ 0 ], BS[ 1 ], .., BS[ n - 2 ] in CSR format:
+   the arcs entering node j are those in the positions Beg[ j ] <= h <
+   Beg[ j + 1 ] of Tail[] and C[], where Tail[ h ] is the tail node of the
+   arc and C[ h ] its cost. Hence, Beg[] has n entries, with Beg[ 0 ] == 0
+   and Beg[ n - 1 ] == m. As the root is node n - 1, BS[ root ] does not
+   exist. Loops ( j , j ) are allowed, and ignored, and so are parallel
+   arcs, of which only the cheapest one is ever used.
+
+   If the instance is feasible, the cost of the optimal arborescence is
+   returned; otherwise, FO_INF is returned, and the results are undefined.
+   */
+
+/*--------------------------------------------------------------------------*/
+/*------------------------ METHODS FOR READING RESULTS ---------------------*/
+/*--------------------------------------------------------------------------*/
+
+   inline bool IsFeasible( void ) const;
+
+/**< Returns true if the last call to Solve() found a feasible solution,
+   i.e., all the nodes are reachable from the root. */
+
+/*--------------------------------------------------------------------------*/
+
+   inline cIndex_Set ReadPred( void ) const;
+
+/**< Returns a read-only vector describing the primal optimal solution of the
+   problem, i.e., the "predecessor" function of the optimal MSA, in the same
+   format as MSArborT::ReadPred(). */
+
+/*--------------------------------------------------------------------------*/
+
+   inline Index GetM( void ) const;
+
+   inline cIndex_Set ReadAux( void ) const;
+
+   inline cCRow GetU( void ) const;
+
+/**< These three methods describe the dual optimal solution of the problem
+   in the same format as the corresponding methods of MSArborT: the nodes of
+   the auxiliary tree are 0, ..., GetM(), where the first n are the original
+   nodes and each of the other ones represents a shrunken component, whose
+   parent in the tree is given by ReadAux(), and GetU()[ i ] is the optimal
+   dual variable associated with node i of the auxiliary tree. */
+
+/*--------------------------------------------------------------------------*/
+/*-------------- METHODS FOR READING THE DATA OF THE PROBLEM ---------------*/
+/*--------------------------------------------------------------------------*/
+
+   inline Index GetN( void ) const;
+
+/**< Returns the size of the problem (number of nodes). */
+
+/*--------------------------------------------------------------------------*/
+/*------------------------------ DESTRUCTOR --------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+   ~SparseMSArborT();
+
+/*--------------------------------------------------------------------------*/
+/*-------------------- PROTECTED PART OF THE CLASS -------------------------*/
+/*--------------------------------------------------------------------------*/
+
+ protected:
+
+/*--------------------------------------------------------------------------*/
+/*-------------------------- PROTECTED METHODS -----------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  inline void Push( SIndex h );
+
+  SIndex Merge( SIndex h1 , SIndex h2 );
+
+  inline Index Find( Index i );
+
+/*--------------------------------------------------------------------------*/
+/*--------------------- PROTECTED DATA STRUCTURES --------------------------*/
+/*--------------------------------------------------------------------------*/
+
+  Index  n;          // Total number of nodes of the graph
+  Index  m;          // size of the dual tree (<= 2 n - 2)
+  Index  root;       // n - 1
+  Index  gsize;      // 2 * n - 2 : max number of nodes in the auxiliary tree
+  SIndex asize;      // current size of the arc arrays
+  bool   feasible;   // true if the last Solve() found a feasible solution
+
+  Index_Set P;       // n array, predecessor function of the optimal tree
+
+  CRow rU;           // ( 2 n - 2 ) array. rU[ j ] == dual variable associated
+                     // with node j
+  Index_Set PARENT;  // ( 2 n - 2 ) array. PARENT[ j ] == predecessor of j in
+                     // the auxiliary tree
+  Index_Set ARCT;    // ( 2 n - 2 ) arrays: ARC*[ j ] == Tail and Head of
+  Index_Set ARCH;    // original arc entering node j (when j is visited)
+  Index_Set LABEL;   // ( 2 n - 2 ) array. LABEL[ j ] == 0 if j has not been
+                     // visited yet, 1 if j is on the current path, 2 if j is
+                     // connected to the root
+  Index_Set STACK;   // ( 2 n - 2 ) array: the current path
+  SIndex *HEAP;      // ( 2 n - 2 ) array. HEAP[ j ] == root of the heap of
+                     // the arcs entering node j
+
+  Index_Set UF;      // n array, union-find of the original nodes: UF[ i ] ==
+                     // i if i is the representative of its set
+  Index_Set CUR;     // n array. CUR[ i ] == the node of the auxiliary tree
+                     // corresponding to the set of representative i
+
+  CRow KEY;          // asize arrays, a node of the heaps for each arc h:
+  CRow ADD;          // KEY[ h ] == the (reduced) cost of h, ADD[ h ] == the
+  SIndex *HL;        // amount to be added to all costs in the subheap
+  SIndex *HR;        // rooted at h, HL[ h ] and HR[ h ] are its sons and
+  unsigned char *HD; // HD[ h ] its distance from the nearest empty subheap
+  Index_Set HEAD;    // (leftist heaps); HEAD[ h ] is the head node of h
+
+/*--------------------------------------------------------------------------*/
+
+ };  // end( class SparseMSArborT )
+
+/*--------------------------------------------------------------------------*/
+/*-------------------------- PREDEFINED TYPES ------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+typedef SparseMSArborT< unsigned short , short , int > SparseMSArbor;
+
+typedef SparseMSArborT< unsigned int , int , long long > SparseMSArborI;
+
+typedef SparseMSArborT< unsigned int , double , double > SparseMSArborD;
+
+/*--------------------------------------------------------------------------*/
+/*------------------- inline methods implementation ------------------------*/
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+constexpr typename SparseMSArborT< IndexT , CNumberT , FONumberT >::Index
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::InINF;
+
+template< class IndexT , class CNumberT , class FONumberT >
+constexpr typename SparseMSArborT< IndexT , CNumberT , FONumberT >::FONumber
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::FO_INF;
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline bool SparseMSArborT< IndexT , CNumberT , FONumberT >::IsFeasible(
+								   void ) const
+{
+ return( feasible );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename SparseMSArborT< IndexT , CNumberT , FONumberT >::cIndex_Set
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::ReadPred( void ) const
+{
+ return( P );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename SparseMSArborT< IndexT , CNumberT , FONumberT >::cIndex_Set
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::ReadAux( void ) const
+{
+ return( PARENT );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename SparseMSArborT< IndexT , CNumberT , FONumberT >::Index
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::GetM( void ) const
+{
+ return( m );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename SparseMSArborT< IndexT , CNumberT , FONumberT >::cCRow
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::GetU( void ) const
+{
+ return ( rU );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+template< class IndexT , class CNumberT , class FONumberT >
+inline typename SparseMSArborT< IndexT , CNumberT , FONumberT >::Index
+ SparseMSArborT< IndexT , CNumberT , FONumberT >::GetN( void ) const
+{
+ return( n );
+ }
+
+/*--------------------------------------------------------------------------*/
+
+ };  // end( namespace MSA_di_unipi_it )
+
+/*--------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+
+#endif  /* SparseMSArbor included */
+
+/*--------------------------------------------------------------------------*/
+/*-------------------- End File SparseMSArbor.h ----------------------------*/
+/*--------------------------------------------------------------------------*/